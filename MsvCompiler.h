@@ -145,6 +145,56 @@ _Pragma("GCC diagnostic ignored \"-Wextra\"")
 #endif // MSV_3RDPARTY_WARNINGS_ON
 
 
+/**************************************************************************************************//**
+* @def			MSV_CACHE_LINE_SIZE
+* @brief			Cache line size.
+* @details		Size (in bytes) used to align and pad data to avoid false sharing (destructive interference
+*					size). Default is 64 bytes. It can be defined before including MarsTech headers to use
+*					another size (e.g. 128 on platforms with bigger cache lines).
+* @see			MSV_CACHE_ALIGNED
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @def			MSV_CACHE_ALIGNED
+* @brief			Cache aligned member.
+* @details		Aligns member to @ref MSV_CACHE_LINE_SIZE when MSV_CACHE_ALIGNED_OBJECTS is defined,
+*					otherwise it is empty. It is used for lock and lifecycle members of MarsTech objects, so
+*					threads spinning on lock do not invalidate cache lines with other members.
+* @warning		MSV_CACHE_ALIGNED_OBJECTS changes layout of objects - it must be defined (or not defined)
+*					same way in all translation units. It requires C++17 (aligned new), otherwise objects
+*					allocated by new would not be aligned.
+* @see			MSV_CACHE_LINE_SIZE
+* @see			MSV_CACHE_PADDING
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @def			MSV_CACHE_PADDING
+* @brief			Cache line padding member.
+* @details		Declares padding member aligned to @ref MSV_CACHE_LINE_SIZE when MSV_CACHE_ALIGNED_OBJECTS
+*					is defined, otherwise it is empty. It must be last member of a class - child members (and
+*					next base classes) are placed in tail padding of the class, so without it they would
+*					share cache line with last @ref MSV_CACHE_ALIGNED member.
+* @param[in]	name					Name of padding member.
+* @see			MSV_CACHE_ALIGNED
+******************************************************************************************************/
+
+
+#ifndef MSV_CACHE_LINE_SIZE
+#define MSV_CACHE_LINE_SIZE 64
+#endif // !MSV_CACHE_LINE_SIZE
+
+#ifdef MSV_CACHE_ALIGNED_OBJECTS
+#if !defined(__cpp_aligned_new) || __cpp_aligned_new < 201606L
+#error MSV_CACHE_ALIGNED_OBJECTS requires C++17 aligned new (objects allocated by new would not be aligned).
+#endif // !__cpp_aligned_new
+#define MSV_CACHE_ALIGNED alignas(MSV_CACHE_LINE_SIZE)
+#define MSV_CACHE_PADDING(name) alignas(MSV_CACHE_LINE_SIZE) char name;
+#else // MSV_CACHE_ALIGNED_OBJECTS
+#define MSV_CACHE_ALIGNED
+#define MSV_CACHE_PADDING(name)
+#endif // MSV_CACHE_ALIGNED_OBJECTS
+
+
 #endif // !MARSTECH_COMPILER_H
 
 /** @} */	//End of group MCOMPILER.
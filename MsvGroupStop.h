@@ -0,0 +1,201 @@
+/**************************************************************************************************//**
+* @addtogroup	MHEADERS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @addtogroup	MOBJECTS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Group Stop
+* @details		Contains definition and implementation of @ref MsvGroupStop function.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Headers.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_GROUPSTOP_H
+#define MARSTECH_GROUPSTOP_H
+
+
+#include "MsvRunnable.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <chrono>
+#include <condition_variable>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Shared pointer check.
+* @details	Value is true when Pointer is std::shared_ptr, otherwise it is false.
+* @see		MsvGroupStop
+******************************************************************************************************/
+template<class Pointer> struct MsvGroupStopSharedPointer: std::false_type {};
+
+/**************************************************************************************************//**
+* @brief		Shared pointer check.
+* @details	Specialization for std::shared_ptr (value is true).
+* @see		MsvGroupStop
+******************************************************************************************************/
+template<class T> struct MsvGroupStopSharedPointer<std::shared_ptr<T>>: std::true_type {};
+
+
+/**************************************************************************************************//**
+* @brief			Stop group of runnable objects.
+* @details		Requests stop (@ref MsvRunnable::RequestStop) of all runnable objects in range
+*					[first, last) at once, then calls stop function for every object in its own thread and
+*					waits until all of them finish or timeout expires. Whole group stop takes at most
+*					timeout.
+* @param[in]	first					Iterator to first runnable object. Dereferenced iterator must be shared
+*											pointer to @ref MsvRunnable (or its child) - detached threads share
+*											ownership of objects. Null pointers and duplicates are ignored.
+* @param[in]	last					Iterator after last runnable object.
+* @param[in]	stopFunction		Function which stops one runnable object (e.g. calls its Stop method). It is
+*											called with shared pointer to the object and it is copied to every
+*											thread.
+* @param[in]	timeout				Overall timeout for whole group (huge timeouts are clamped, so
+*											std::chrono::steady_clock::duration::max() waits until all objects stop).
+* @returns		std::vector<Pointer>
+* @returns		Shared pointers to runnable objects which have not been stopped - their stop function has
+*					not finished in timeout or it has thrown exception (empty when all objects have been
+*					stopped).
+* @warning		Stop functions of not stopped objects can still be running in detached threads after
+*					return. Stop function must not capture anything by reference (or by raw pointer) which
+*					can be destroyed after return - capture by value or by shared pointer.
+* @note			Every object has its own thread (no thread pool) - stop function blocked on I/O would
+*					hold pool thread and delay stop of other objects beyond timeout.
+* @see			MsvRunnable
+******************************************************************************************************/
+template<class Iterator, class StopFunction, class Rep, class Period>
+std::vector<typename std::iterator_traits<Iterator>::value_type> MsvGroupStop(Iterator first, Iterator last, StopFunction stopFunction, const std::chrono::duration<Rep, Period>& timeout)
+{
+	using Pointer = typename std::iterator_traits<Iterator>::value_type;
+
+	static_assert(MsvGroupStopSharedPointer<Pointer>::value, "MsvGroupStop requires range of std::shared_ptr (detached threads share ownership of objects).");
+
+	struct GroupState
+	{
+		std::mutex lock;
+		std::condition_variable finishedCondition;
+		std::vector<bool> stopped;
+		size_t remaining;
+	};
+
+	//deadline is clamped -> now + timeout would overflow for huge timeouts
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+	if (std::chrono::duration<double>(timeout) < std::chrono::duration<double>(deadline - now))
+	{
+		deadline = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+	}
+
+	//null pointers and duplicates are ignored -> stop function must not run twice on one object at once
+	std::vector<Pointer> runnables;
+	std::set<typename Pointer::element_type*> added;
+	for (; first != last; ++first)
+	{
+		if (*first && added.insert((*first).get()).second)
+		{
+			runnables.push_back(*first);
+		}
+	}
+
+	//signal all objects first -> they can finish their work in parallel
+	for (Pointer& runnable : runnables)
+	{
+		runnable->RequestStop();
+	}
+
+	std::shared_ptr<GroupState> spState = std::make_shared<GroupState>();
+	spState->stopped.resize(runnables.size(), false);
+	spState->remaining = runnables.size();
+
+	for (size_t index = 0; index < runnables.size(); ++index)
+	{
+		try
+		{
+			Pointer runnable = runnables[index];
+
+			std::thread([spState, stopFunction, runnable, index]() mutable
+			{
+				bool stopped = false;
+
+				try
+				{
+					stopFunction(runnable);
+					stopped = true;
+				}
+				catch (...)
+				{
+					//stop function failed -> object is reported as not stopped
+				}
+
+				std::lock_guard<std::mutex> lock(spState->lock);
+				spState->stopped[index] = stopped;
+				--spState->remaining;
+				spState->finishedCondition.notify_all();
+			}).detach();
+		}
+		catch (const std::system_error&)
+		{
+			//thread not started -> object is reported as not stopped (do not wait for it)
+			std::lock_guard<std::mutex> lock(spState->lock);
+			--spState->remaining;
+		}
+	}
+
+	std::vector<Pointer> notStopped;
+
+	std::unique_lock<std::mutex> lock(spState->lock);
+	spState->finishedCondition.wait_until(lock, deadline, [&spState]() { return spState->remaining == 0; });
+
+	for (size_t index = 0; index < runnables.size(); ++index)
+	{
+		if (!spState->stopped[index])
+		{
+			notStopped.push_back(runnables[index]);
+		}
+	}
+
+	return notStopped;
+}
+
+
+#endif // !MARSTECH_GROUPSTOP_H
+
+/** @} */	//End of group MOBJECTS.
+
+/** @} */	//End of group MHEADERS
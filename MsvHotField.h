@@ -0,0 +1,153 @@
+/**************************************************************************************************//**
+* @addtogroup	MHEADERS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @addtogroup	MOBJECTS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Hot Field
+* @details		Contains definition and implementation of @ref MsvHotField class.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Headers.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_HOTFIELD_H
+#define MARSTECH_HOTFIELD_H
+
+
+#include "MsvCompiler.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <type_traits>
+#include <utility>
+
+MSV_ENABLE_WARNINGS
+
+
+#if !defined(__cpp_aligned_new) || __cpp_aligned_new < 201606L
+#error MsvHotField requires C++17 aligned new (objects allocated by new would not be aligned).
+#endif // !__cpp_aligned_new
+
+
+/**************************************************************************************************//**
+* @brief		Hot field copy check.
+* @details	Value is true when Args is one argument of HotField type (copy or move), otherwise false.
+* @see		MsvHotField
+******************************************************************************************************/
+template<class HotField, class... Args> struct MsvHotFieldCopy: std::false_type {};
+
+/**************************************************************************************************//**
+* @brief		Hot field copy check.
+* @details	Specialization for one argument.
+* @see		MsvHotField
+******************************************************************************************************/
+template<class HotField, class Arg> struct MsvHotFieldCopy<HotField, Arg>:
+	std::is_same<HotField, typename std::decay<Arg>::type> {};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Hot Field.
+* @details	Wraps frequently accessed (hot) member. It is always aligned and padded to
+*				@ref MSV_CACHE_LINE_SIZE, so it has its own cache line and writes to it do not slow down
+*				threads which access other members (false sharing).
+* @note		It does not depend on MSV_CACHE_ALIGNED_OBJECTS - use it only for really hot members,
+*				every hot field takes at least one cache line.
+* @note		It requires C++17 (aligned new), otherwise objects with hot field allocated by new would
+*				not be aligned.
+* @see		MSV_CACHE_ALIGNED
+******************************************************************************************************/
+template<class T> class alignas(MSV_CACHE_LINE_SIZE) MsvHotField
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @details		Constructs wrapped value from arguments. It is disabled when the only argument is
+	*					hot field -> copy and move constructors (implicitly defined from T) are used instead.
+	* @param[in]	args					Arguments passed to value constructor.
+	******************************************************************************************************/
+	template<class... Args, typename std::enable_if<!MsvHotFieldCopy<MsvHotField, Args...>::value, int>::type = 0>
+	explicit MsvHotField(Args&&... args):
+		m_value(std::forward<Args>(args)...)
+	{
+
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Get value.
+	* @returns		T&
+	* @returns		Reference to wrapped value.
+	******************************************************************************************************/
+	T& Get()
+	{
+		return m_value;
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Get value.
+	* @returns		const T&
+	* @returns		Const reference to wrapped value.
+	******************************************************************************************************/
+	const T& Get() const
+	{
+		return m_value;
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Member access operator.
+	* @returns		T*
+	* @returns		Pointer to wrapped value.
+	******************************************************************************************************/
+	T* operator-> ()
+	{
+		return &m_value;
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Member access operator.
+	* @returns		const T*
+	* @returns		Const pointer to wrapped value.
+	******************************************************************************************************/
+	const T* operator-> () const
+	{
+		return &m_value;
+	}
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Wrapped value.
+	******************************************************************************************************/
+	T m_value;
+};
+
+
+#endif // !MARSTECH_HOTFIELD_H
+
+/** @} */	//End of group MOBJECTS.
+
+/** @} */	//End of group MHEADERS
@@ -105,7 +105,14 @@ protected:
 	* @details	Flag if object is initialized (true) or not (false).
 	* @see		Initialized
 	******************************************************************************************************/
-	bool m_initialized;
+	MSV_CACHE_ALIGNED bool m_initialized;
+
+	/**************************************************************************************************//**
+	* @brief		Cache line padding.
+	* @details	Child members start on new cache line (not on cache line with @ref m_initialized).
+	* @see		MSV_CACHE_PADDING
+	******************************************************************************************************/
+	MSV_CACHE_PADDING(m_initializedPadding)
 };
 
 
@@ -53,6 +53,9 @@ MSV_DISABLE_ALL_WARNINGS
 MSV_ENABLE_WARNINGS
 
 
+class MsvMultiLock;
+
+
 /**************************************************************************************************//**
 * @brief		MarsTech Lockable Object.
 * @details	Lockable object. It has @ref m_lock member which locks this object for thread safety access.
@@ -89,13 +92,27 @@ public:
 	******************************************************************************************************/
 	MsvLockable& operator= (const MsvLockable& origin) = delete;
 
+	/**************************************************************************************************//**
+	* @brief		Multi lock is friend.
+	* @details	It locks @ref m_lock of several lockable objects at once.
+	* @see		MsvMultiLock
+	******************************************************************************************************/
+	friend class MsvMultiLock;
+
 protected:
 	/**************************************************************************************************//**
 	* @brief		Thread pool mutex.
 	* @details	Locks this object for thread safety access.
 	* @note		Mutable to be possible to lock even in const methods.
 	******************************************************************************************************/
-	mutable std::recursive_mutex m_lock;
+	MSV_CACHE_ALIGNED mutable std::recursive_mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Cache line padding.
+	* @details	Child members start on new cache line (not on cache line with @ref m_lock).
+	* @see		MSV_CACHE_PADDING
+	******************************************************************************************************/
+	MSV_CACHE_PADDING(m_lockPadding)
 };
 
 
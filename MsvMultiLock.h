@@ -0,0 +1,258 @@
+/**************************************************************************************************//**
+* @addtogroup	MHEADERS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @addtogroup	MOBJECTS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Multi Lock
+* @details		Contains definition and implementation of @ref MsvMultiLock class.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech Headers.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_MULTILOCK_H
+#define MARSTECH_MULTILOCK_H
+
+
+#include "MsvLockable.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Multi Lock.
+* @details	Scoped guard which locks @ref MsvLockable::m_lock of several lockable objects at once and
+*				unlocks them in its destructor. Locks are always acquired in ascending order of object
+*				addresses, so two multi locks over overlapping sets of objects can not deadlock each other.
+*				Null pointers and duplicate objects are ignored.
+* @warning	Deadlock freedom holds only when no lock of any @ref MsvLockable is held by the thread when
+*				multi lock is constructed - not even a lock of an object which is part of the multi lock.
+*				E.g. thread 1 holds B and multi locks {A, B} while thread 2 multi locks {A, B} and holds
+*				A -> deadlock. @ref MsvLockable::m_lock is recursive, but that does not help here.
+* @see		MsvLockable
+******************************************************************************************************/
+class MsvMultiLock
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @details		Locks all lockable objects in range [first, last).
+	* @param[in]	first					Iterator to first object. Dereferenced iterator must be pointer
+	*											(raw or smart) to @ref MsvLockable (or its child).
+	* @param[in]	last					Iterator after last object.
+	******************************************************************************************************/
+	template<class Iterator> MsvMultiLock(Iterator first, Iterator last):
+		m_pLockables(m_inlineLockables),
+		m_count(0)
+	{
+		Reserve(first, last, typename std::iterator_traits<Iterator>::iterator_category());
+
+		for (; first != last; ++first)
+		{
+			if (*first)
+			{
+				Add(static_cast<const MsvLockable*>(&**first));
+			}
+		}
+
+		Lock();
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @details		Locks all lockable objects in list.
+	* @param[in]	lockables			List of pointers to lockable objects.
+	******************************************************************************************************/
+	MsvMultiLock(std::initializer_list<const MsvLockable*> lockables):
+		MsvMultiLock(lockables.begin(), lockables.end())
+	{
+
+	}
+
+	/**************************************************************************************************//**
+	* @brief		Destructor.
+	* @details	Unlocks all locked objects (in reverse order).
+	******************************************************************************************************/
+	~MsvMultiLock()
+	{
+		Unlock(m_count);
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Deleted copy constructor.
+	* @details		Copy constructor deleted -> copying is not allowed.
+	* @param[in]	origin			Reference to copyied object.
+	* @warning		Do not copy this object.
+	******************************************************************************************************/
+	MsvMultiLock(const MsvMultiLock& origin) = delete;
+
+	/**************************************************************************************************//**
+	* @brief			Deleted assign operator.
+	* @details		Assign operator deleted -> assign is not allowed.
+	* @param[in]	origin			Reference to assigned object.
+	* @warning		Do not assign this object.
+	******************************************************************************************************/
+	MsvMultiLock& operator= (const MsvMultiLock& origin) = delete;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Inline capacity.
+	* @details	Count of objects which are stored without heap allocation.
+	******************************************************************************************************/
+	static const size_t INLINE_CAPACITY = 8;
+
+	/**************************************************************************************************//**
+	* @brief			Reserve storage.
+	* @details		Reserves heap storage when range of forward iterators does not fit inline storage.
+	* @param[in]	first					Iterator to first object.
+	* @param[in]	last					Iterator after last object.
+	******************************************************************************************************/
+	template<class Iterator> void Reserve(Iterator first, Iterator last, std::forward_iterator_tag)
+	{
+		size_t count = static_cast<size_t>(std::distance(first, last));
+
+		if (count > INLINE_CAPACITY)
+		{
+			m_heapLockables.reserve(count);
+		}
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Reserve storage.
+	* @details		Input iterators can not be passed twice -> nothing is reserved.
+	******************************************************************************************************/
+	template<class Iterator> void Reserve(Iterator, Iterator, std::input_iterator_tag)
+	{
+
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Add object.
+	* @details		Stores object in inline storage. When inline storage is full, objects are moved to
+	*					heap storage.
+	* @param[in]	pLockable			Pointer to lockable object.
+	******************************************************************************************************/
+	void Add(const MsvLockable* pLockable)
+	{
+		if (m_pLockables == m_inlineLockables && m_count == INLINE_CAPACITY)
+		{
+			m_heapLockables.assign(m_inlineLockables, m_inlineLockables + m_count);
+		}
+
+		if (m_count < INLINE_CAPACITY && m_heapLockables.empty())
+		{
+			m_inlineLockables[m_count] = pLockable;
+		}
+		else
+		{
+			m_heapLockables.push_back(pLockable);
+			m_pLockables = m_heapLockables.data();
+		}
+
+		++m_count;
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Lock objects.
+	* @details		Sorts objects by address, removes duplicates and locks them in that order. When
+	*					locking fails, already locked objects are unlocked and exception is rethrown.
+	******************************************************************************************************/
+	void Lock()
+	{
+		std::sort(m_pLockables, m_pLockables + m_count, std::less<const MsvLockable*>());
+		m_count = static_cast<size_t>(std::unique(m_pLockables, m_pLockables + m_count) - m_pLockables);
+
+		size_t locked = 0;
+
+		try
+		{
+			for (; locked < m_count; ++locked)
+			{
+				m_pLockables[locked]->m_lock.lock();
+			}
+		}
+		catch (...)
+		{
+			Unlock(locked);
+			throw;
+		}
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Unlock objects.
+	* @details		Unlocks first count objects in reverse order.
+	* @param[in]	count					Count of locked objects.
+	******************************************************************************************************/
+	void Unlock(size_t count)
+	{
+		while (count > 0)
+		{
+			m_pLockables[--count]->m_lock.unlock();
+		}
+	}
+
+	/**************************************************************************************************//**
+	* @brief		Inline storage.
+	* @details	Stores up to @ref INLINE_CAPACITY objects -> small multi locks do not allocate.
+	******************************************************************************************************/
+	const MsvLockable* m_inlineLockables[INLINE_CAPACITY];
+
+	/**************************************************************************************************//**
+	* @brief		Heap storage.
+	* @details	Used when objects do not fit @ref m_inlineLockables.
+	******************************************************************************************************/
+	std::vector<const MsvLockable*> m_heapLockables;
+
+	/**************************************************************************************************//**
+	* @brief		Locked objects.
+	* @details	Points to @ref m_inlineLockables or to @ref m_heapLockables data. Objects are sorted by
+	*				address (after @ref Lock).
+	******************************************************************************************************/
+	const MsvLockable** m_pLockables;
+
+	/**************************************************************************************************//**
+	* @brief		Count of locked objects.
+	******************************************************************************************************/
+	size_t m_count;
+};
+
+
+#endif // !MARSTECH_MULTILOCK_H
+
+/** @} */	//End of group MOBJECTS.
+
+/** @} */	//End of group MHEADERS
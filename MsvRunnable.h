@@ -42,11 +42,19 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 
 #include "MsvInitiliable.h"
 
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+
+MSV_ENABLE_WARNINGS
+
 
 /**************************************************************************************************//**
 * @brief		MarsTech Runnable Object.
 * @details	Runnable object. It has @ref m_running member which is flag if object is running
 *				(true) or not (false). It is set to false in constructor.
+*				It has also cooperative cancellation token (@ref m_stopRequested) which can be checked
+*				without locking from worker loops (see @ref StopRequested).
 * @see		MsvInitiliable
 ******************************************************************************************************/
 template<class InterfaceClass> class MsvRunnable:
@@ -59,7 +67,8 @@ public:
 	******************************************************************************************************/
 	MsvRunnable():
 		MsvInitiliable<InterfaceClass>(),
-		m_running(false)
+		m_running(false),
+		m_stopRequested(false)
 	{
 
 	}
@@ -98,13 +107,65 @@ public:
 		return m_running;
 	}
 
+	/**************************************************************************************************//**
+	* @brief		Request stop.
+	* @details	Sets cancellation token (@ref m_stopRequested). It does not lock and does not wait -> it
+	*				only signals worker loops they should finish as soon as possible. Object should still be
+	*				stopped by Stop method (implemented by a child).
+	* @see		StopRequested
+	******************************************************************************************************/
+	virtual void RequestStop()
+	{
+		m_stopRequested.store(true, std::memory_order_release);
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Stop requested check.
+	* @details		Returns flag if stop has been requested (true) or not (false). It does not lock so it
+	*					is cheap enough to be checked in every iteration of worker loops.
+	* @retval		true		When stop has been requested.
+	* @retval		false		When stop has not been requested.
+	* @see			RequestStop
+	******************************************************************************************************/
+	bool StopRequested() const
+	{
+		return m_stopRequested.load(std::memory_order_acquire);
+	}
+
 protected:
+	/**************************************************************************************************//**
+	* @brief		Clear stop request.
+	* @details	Resets cancellation token (@ref m_stopRequested). It should be called by a child when
+	*				object is started again.
+	* @see		RequestStop
+	******************************************************************************************************/
+	void ClearStopRequest()
+	{
+		m_stopRequested.store(false, std::memory_order_release);
+	}
+
 	/**************************************************************************************************//**
 	* @brief		Running flag.
 	* @details	Flag if object is running (true) or not (false).
 	* @see		Running
 	******************************************************************************************************/
-	bool m_running;
+	MSV_CACHE_ALIGNED bool m_running;
+
+	/**************************************************************************************************//**
+	* @brief		Stop requested flag (cancellation token).
+	* @details	Flag if stop has been requested (true) or not (false). It is atomic and can be read
+	*				without locking @ref m_lock.
+	* @see		StopRequested
+	* @see		RequestStop
+	******************************************************************************************************/
+	MSV_CACHE_ALIGNED std::atomic<bool> m_stopRequested;
+
+	/**************************************************************************************************//**
+	* @brief		Cache line padding.
+	* @details	Child members start on new cache line (not on cache line with @ref m_stopRequested).
+	* @see		MSV_CACHE_PADDING
+	******************************************************************************************************/
+	MSV_CACHE_PADDING(m_stopRequestedPadding)
 };
 
 
@@ -0,0 +1,281 @@
+//False sharing between lock and lifecycle fields of MsvRunnable.
+//Locker threads spin on m_lock (lock/unlock), reader threads check StopRequested (m_stopRequested) and
+//read child field in a loop. Reader threads never touch the lock, so any slowdown of readers is caused by
+//lock writes invalidating their cache lines.
+//
+//This file is built twice: mheaders_falsesharing_benchmark (default layout) and
+//mheaders_falsesharing_benchmark_aligned (MSV_CACHE_ALIGNED_OBJECTS). Compare their outputs.
+//Reader threads are measured by perf counters (Linux perf_event_open) when they are available.
+//
+//Usage: mheaders_falsesharing_benchmark[_aligned] [readers] [lockers] [milliseconds]
+
+#include "MsvRunnable.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // __linux__
+
+
+enum PerfEvent
+{
+	PERF_EVENT_CYCLES = 0,
+	PERF_EVENT_INSTRUCTIONS,
+	PERF_EVENT_L1D_READ_MISSES,
+	PERF_EVENT_CACHE_MISSES,
+	PERF_EVENT_COUNT
+};
+
+const char* const g_perfEventNames[PERF_EVENT_COUNT] = {"cycles", "instructions", "L1D read misses", "cache misses"};
+
+
+//one perf counter of calling thread (user space only)
+class PerfCounter
+{
+public:
+	PerfCounter(PerfEvent event):
+		m_fd(-1)
+	{
+#ifdef __linux__
+		perf_event_attr attributes;
+		std::memset(&attributes, 0, sizeof(attributes));
+		attributes.size = sizeof(attributes);
+
+		switch (event)
+		{
+		case PERF_EVENT_CYCLES:
+			attributes.type = PERF_TYPE_HARDWARE;
+			attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+			break;
+		case PERF_EVENT_INSTRUCTIONS:
+			attributes.type = PERF_TYPE_HARDWARE;
+			attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+			break;
+		case PERF_EVENT_L1D_READ_MISSES:
+			attributes.type = PERF_TYPE_HW_CACHE;
+			attributes.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+			break;
+		default:
+			attributes.type = PERF_TYPE_HARDWARE;
+			attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+			break;
+		}
+
+		attributes.disabled = 1;
+		attributes.exclude_kernel = 1;
+		attributes.exclude_hv = 1;
+
+		m_fd = static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+		if (m_fd >= 0)
+		{
+			ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+			ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+		}
+#else
+		(void)event;
+#endif // __linux__
+	}
+
+	~PerfCounter()
+	{
+#ifdef __linux__
+		if (m_fd >= 0)
+		{
+			close(m_fd);
+		}
+#endif // __linux__
+	}
+
+	PerfCounter(const PerfCounter& origin) = delete;
+	PerfCounter& operator= (const PerfCounter& origin) = delete;
+
+	//returns false when counter is not available
+	bool Read(uint64_t& value)
+	{
+#ifdef __linux__
+		if (m_fd >= 0)
+		{
+			ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+			return read(m_fd, &value, sizeof(value)) == static_cast<ssize_t>(sizeof(value));
+		}
+#endif // __linux__
+
+		(void)value;
+		return false;
+	}
+
+protected:
+	int m_fd;
+};
+
+
+struct PerfResult
+{
+	uint64_t values[PERF_EVENT_COUNT] = {};
+	bool available[PERF_EVENT_COUNT] = {true, true, true, true};
+};
+
+
+class BenchmarkInterface
+{
+public:
+	virtual ~BenchmarkInterface() = default;
+};
+
+
+class BenchmarkRunnable:
+	public MsvRunnable<BenchmarkInterface>
+{
+public:
+	void LockUnlock()
+	{
+		m_lock.lock();
+		m_lock.unlock();
+	}
+
+	void PrintLayout() const
+	{
+		const char* pThis = reinterpret_cast<const char*>(this);
+
+		std::printf("sizeof(MsvRunnable): %zu bytes\n", sizeof(MsvRunnable<BenchmarkInterface>));
+		std::printf("offsets: m_lock %td, m_initialized %td, m_running %td, m_stopRequested %td, child field %td\n",
+			reinterpret_cast<const char*>(&m_lock) - pThis, reinterpret_cast<const char*>(&m_initialized) - pThis,
+			reinterpret_cast<const char*>(&m_running) - pThis, reinterpret_cast<const char*>(&m_stopRequested) - pThis,
+			reinterpret_cast<const char*>(&m_childField) - pThis);
+		std::printf("cache line of m_lock shared with: m_stopRequested %s, child field %s\n",
+			SharesLockLine(&m_stopRequested) ? "yes" : "no", SharesLockLine(&m_childField) ? "yes" : "no");
+	}
+
+	bool SharesLockLine(const void* pField) const
+	{
+		uintptr_t lockFirstLine = reinterpret_cast<uintptr_t>(&m_lock) / MSV_CACHE_LINE_SIZE;
+		uintptr_t lockLastLine = (reinterpret_cast<uintptr_t>(&m_lock) + sizeof(m_lock) - 1) / MSV_CACHE_LINE_SIZE;
+		uintptr_t fieldLine = reinterpret_cast<uintptr_t>(pField) / MSV_CACHE_LINE_SIZE;
+
+		return fieldLine >= lockFirstLine && fieldLine <= lockLastLine;
+	}
+
+	//child field read by reader threads
+	std::atomic<int64_t> m_childField{1};
+};
+
+
+int main(int argc, char* argv[])
+{
+	unsigned hardwareThreads = std::max(2u, std::thread::hardware_concurrency());
+	size_t readers = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : hardwareThreads / 2;
+	size_t lockers = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : hardwareThreads - hardwareThreads / 2;
+	std::chrono::milliseconds duration(argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 2000);
+
+#ifdef MSV_CACHE_ALIGNED_OBJECTS
+	std::printf("layout: MSV_CACHE_ALIGNED_OBJECTS (cache line %d bytes)\n", MSV_CACHE_LINE_SIZE);
+#else
+	std::printf("layout: default\n");
+#endif // MSV_CACHE_ALIGNED_OBJECTS
+
+	std::printf("readers: %zu, lockers: %zu, duration: %lld ms\n", readers, lockers, static_cast<long long>(duration.count()));
+
+	//object starts on cache line boundary -> sharing of cache lines does not depend on stack layout
+	alignas(MSV_CACHE_LINE_SIZE) BenchmarkRunnable runnable;
+	runnable.PrintLayout();
+
+	std::atomic<bool> stopLockers(false);
+	std::atomic<uint64_t> readIterations(0);
+	std::atomic<uint64_t> lockIterations(0);
+	std::mutex resultLock;
+	PerfResult result;
+
+	std::vector<std::thread> threads;
+
+	for (size_t i = 0; i < lockers; ++i)
+	{
+		threads.emplace_back([&runnable, &stopLockers, &lockIterations]()
+		{
+			uint64_t iterations = 0;
+
+			while (!stopLockers.load(std::memory_order_relaxed))
+			{
+				runnable.LockUnlock();
+				++iterations;
+			}
+
+			lockIterations += iterations;
+		});
+	}
+
+	for (size_t i = 0; i < readers; ++i)
+	{
+		threads.emplace_back([&runnable, &readIterations, &resultLock, &result]()
+		{
+			PerfCounter cycles(PERF_EVENT_CYCLES);
+			PerfCounter instructions(PERF_EVENT_INSTRUCTIONS);
+			PerfCounter l1dReadMisses(PERF_EVENT_L1D_READ_MISSES);
+			PerfCounter cacheMisses(PERF_EVENT_CACHE_MISSES);
+			PerfCounter* counters[PERF_EVENT_COUNT] = {&cycles, &instructions, &l1dReadMisses, &cacheMisses};
+
+			uint64_t iterations = 0;
+			int64_t sum = 0;
+
+			//readers are stopped by cancellation token of the object itself
+			while (!runnable.StopRequested())
+			{
+				sum += runnable.m_childField.load(std::memory_order_relaxed);
+				++iterations;
+			}
+
+			std::lock_guard<std::mutex> lock(resultLock);
+			for (int event = 0; event < PERF_EVENT_COUNT; ++event)
+			{
+				uint64_t value = 0;
+				result.available[event] = counters[event]->Read(value) && result.available[event];
+				result.values[event] += value;
+			}
+
+			readIterations += iterations;
+			readIterations += sum == 0 ? 1 : 0;	//uses sum -> loop is not optimized out
+		});
+	}
+
+	std::this_thread::sleep_for(duration);
+	runnable.RequestStop();
+	stopLockers = true;
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	double seconds = std::chrono::duration<double>(duration).count();
+	uint64_t reads = std::max<uint64_t>(1, readIterations.load());
+
+	std::printf("reader iterations: %14.0f /s\n", static_cast<double>(readIterations.load()) / seconds);
+	std::printf("lock/unlock:       %14.0f /s\n", static_cast<double>(lockIterations.load()) / seconds);
+
+	for (int event = 0; event < PERF_EVENT_COUNT; ++event)
+	{
+		if (result.available[event])
+		{
+			std::printf("reader %-16s %14llu (%.3f per iteration)\n", g_perfEventNames[event], static_cast<unsigned long long>(result.values[event]),
+				static_cast<double>(result.values[event]) / static_cast<double>(reads));
+		}
+		else
+		{
+			std::printf("reader %-16s %14s (perf counters not available, check /proc/sys/kernel/perf_event_paranoid)\n", g_perfEventNames[event], "n/a");
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
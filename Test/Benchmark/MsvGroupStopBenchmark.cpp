@@ -0,0 +1,133 @@
+//Shutdown wall time of many runnable components: sequential Stop compared to MsvGroupStop.
+//Every component has worker thread which checks cancellation token and its Stop joins the worker and
+//then blocks for some time (e.g. flushing to disk or closing connection). Some components can be stuck
+//(their Stop blocks much longer than deadline).
+//
+//Usage: mheaders_groupstop_benchmark [components] [stopMilliseconds] [stuckComponents] [deadlineMilliseconds]
+
+#include "MsvGroupStop.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+class BenchmarkRunnableInterface
+{
+public:
+	virtual ~BenchmarkRunnableInterface() = default;
+
+	virtual void Stop() = 0;
+};
+
+
+class BenchmarkRunnable:
+	public MsvRunnable<BenchmarkRunnableInterface>
+{
+public:
+	BenchmarkRunnable(std::chrono::milliseconds stopDuration):
+		m_stopDuration(stopDuration),
+		m_worker(&BenchmarkRunnable::WorkerLoop, this)
+	{
+
+	}
+
+	~BenchmarkRunnable()
+	{
+		if (m_worker.joinable())
+		{
+			RequestStop();
+			m_worker.join();
+		}
+	}
+
+	virtual void Stop() override
+	{
+		RequestStop();
+
+		if (m_worker.joinable())
+		{
+			m_worker.join();
+		}
+
+		std::this_thread::sleep_for(m_stopDuration);
+	}
+
+protected:
+	void WorkerLoop()
+	{
+		while (!StopRequested())
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+
+	std::chrono::milliseconds m_stopDuration;
+	std::thread m_worker;
+};
+
+
+std::vector<std::shared_ptr<BenchmarkRunnable>> CreateComponents(size_t components, std::chrono::milliseconds stopDuration, size_t stuckComponents, std::chrono::milliseconds stuckDuration)
+{
+	std::vector<std::shared_ptr<BenchmarkRunnable>> runnables;
+
+	for (size_t i = 0; i < components; ++i)
+	{
+		runnables.push_back(std::make_shared<BenchmarkRunnable>(i < stuckComponents ? stuckDuration : stopDuration));
+	}
+
+	return runnables;
+}
+
+double Milliseconds(std::chrono::steady_clock::duration duration)
+{
+	return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+int main(int argc, char* argv[])
+{
+	size_t components = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500;
+	std::chrono::milliseconds stopDuration(argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20);
+	size_t stuckComponents = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 5;
+	std::chrono::milliseconds deadline(argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 2000);
+	std::chrono::milliseconds stuckDuration = deadline * 2;
+
+	std::printf("components: %zu, stop: %lld ms, stuck components: %zu (stop %lld ms), deadline: %lld ms\n", components,
+		static_cast<long long>(stopDuration.count()), stuckComponents, static_cast<long long>(stuckDuration.count()),
+		static_cast<long long>(deadline.count()));
+
+	//sequential stop - what Stop loop without group stop does
+	{
+		std::vector<std::shared_ptr<BenchmarkRunnable>> runnables = CreateComponents(components, stopDuration, stuckComponents, stuckDuration);
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (std::shared_ptr<BenchmarkRunnable>& spRunnable : runnables)
+		{
+			spRunnable->Stop();
+		}
+
+		std::printf("sequential Stop: %10.1f ms\n", Milliseconds(std::chrono::steady_clock::now() - start));
+	}
+
+	//group stop
+	{
+		std::vector<std::shared_ptr<BenchmarkRunnable>> runnables = CreateComponents(components, stopDuration, stuckComponents, stuckDuration);
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		std::vector<std::shared_ptr<BenchmarkRunnable>> notStopped = MsvGroupStop(runnables.begin(), runnables.end(),
+			[](std::shared_ptr<BenchmarkRunnable>& spRunnable) { spRunnable->Stop(); }, deadline);
+
+		std::printf("MsvGroupStop:    %10.1f ms (%zu components missed deadline)\n", Milliseconds(std::chrono::steady_clock::now() - start),
+			notStopped.size());
+
+		//stuck components are still stopping in background -> wait for them before exit
+		runnables.clear();
+		notStopped.clear();
+		std::this_thread::sleep_for(stuckDuration);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,128 @@
+//Throughput of MsvMultiLock compared to one global lock.
+//Every operation locks random set of objects and updates them ("transfer"). With one global lock all
+//operations are serialized, with MsvMultiLock operations over disjoint sets run in parallel.
+//
+//Usage: mheaders_multilock_benchmark [threads] [objects] [lockSetSize] [milliseconds]
+
+#include "MsvMultiLock.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+
+class BenchmarkLockable:
+	public MsvLockable
+{
+public:
+	int64_t m_value = 0;
+};
+
+
+struct BenchmarkConfig
+{
+	size_t threads;
+	size_t objects;
+	size_t lockSetSize;
+	std::chrono::milliseconds duration;
+};
+
+
+//simulates some work done with locked objects
+void Transfer(std::vector<BenchmarkLockable*>& lockSet)
+{
+	for (int i = 0; i < 16; ++i)
+	{
+		lockSet.front()->m_value -= 1;
+		lockSet.back()->m_value += 1;
+	}
+}
+
+template<class LockFunction> double Run(const BenchmarkConfig& config, std::vector<std::unique_ptr<BenchmarkLockable>>& objects, LockFunction lockFunction)
+{
+	std::atomic<bool> stop(false);
+	std::atomic<uint64_t> operations(0);
+	std::vector<std::thread> threads;
+
+	for (size_t t = 0; t < config.threads; ++t)
+	{
+		threads.emplace_back([&, t]()
+		{
+			std::mt19937 random(static_cast<unsigned>(t));
+			std::vector<BenchmarkLockable*> lockSet(config.lockSetSize);
+			uint64_t localOperations = 0;
+
+			while (!stop.load(std::memory_order_relaxed))
+			{
+				for (BenchmarkLockable*& pObject : lockSet)
+				{
+					pObject = objects[random() % objects.size()].get();
+				}
+
+				lockFunction(lockSet);
+				++localOperations;
+			}
+
+			operations += localOperations;
+		});
+	}
+
+	std::this_thread::sleep_for(config.duration);
+	stop = true;
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	return static_cast<double>(operations.load()) / std::chrono::duration<double>(config.duration).count();
+}
+
+int main(int argc, char* argv[])
+{
+	BenchmarkConfig config;
+	config.threads = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : std::max(2u, std::thread::hardware_concurrency());
+	config.objects = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1024;
+	config.lockSetSize = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 4;
+	config.duration = std::chrono::milliseconds(argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 2000);
+
+	std::vector<std::unique_ptr<BenchmarkLockable>> objects;
+	for (size_t i = 0; i < config.objects; ++i)
+	{
+		objects.push_back(std::unique_ptr<BenchmarkLockable>(new BenchmarkLockable()));
+	}
+
+	std::printf("threads: %zu, objects: %zu, lock set size: %zu, duration: %lld ms\n", config.threads, config.objects,
+		config.lockSetSize, static_cast<long long>(config.duration.count()));
+
+	std::mutex globalLock;
+	double globalThroughput = Run(config, objects, [&globalLock](std::vector<BenchmarkLockable*>& lockSet)
+	{
+		std::lock_guard<std::mutex> lock(globalLock);
+		Transfer(lockSet);
+	});
+
+	double multiLockThroughput = Run(config, objects, [](std::vector<BenchmarkLockable*>& lockSet)
+	{
+		MsvMultiLock lock(lockSet.begin(), lockSet.end());
+		Transfer(lockSet);
+	});
+
+	int64_t sum = 0;
+	for (std::unique_ptr<BenchmarkLockable>& spObject : objects)
+	{
+		sum += spObject->m_value;
+	}
+
+	std::printf("global lock:   %12.0f ops/s\n", globalThroughput);
+	std::printf("MsvMultiLock:  %12.0f ops/s (%.2fx)\n", multiLockThroughput, multiLockThroughput / globalThroughput);
+
+	return sum == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,93 @@
+//Compiled with MSV_CACHE_ALIGNED_OBJECTS (see CMakeLists.txt).
+
+#include "MsvRunnable.h"
+#include "MsvHotField.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <set>
+
+
+#ifndef MSV_CACHE_ALIGNED_OBJECTS
+#error MsvCacheLayoutTest.cpp must be compiled with MSV_CACHE_ALIGNED_OBJECTS.
+#endif // !MSV_CACHE_ALIGNED_OBJECTS
+
+
+class TestLayoutInterface
+{
+public:
+	virtual ~TestLayoutInterface() = default;
+};
+
+
+uintptr_t CacheLine(const void* pAddress)
+{
+	return reinterpret_cast<uintptr_t>(pAddress) / MSV_CACHE_LINE_SIZE;
+}
+
+
+class TestLayoutLockable:
+	public MsvLockable
+{
+public:
+	bool ChildSharesLockLine() const
+	{
+		//last byte of lock and first child member
+		return CacheLine(reinterpret_cast<const char*>(&m_lock) + sizeof(m_lock) - 1) == CacheLine(&m_childValue);
+	}
+
+	int m_childValue = 0;
+};
+
+
+class TestLayoutRunnable:
+	public MsvRunnable<TestLayoutInterface>
+{
+public:
+	std::set<uintptr_t> FieldLines() const
+	{
+		return {CacheLine(&m_lock), CacheLine(reinterpret_cast<const char*>(&m_lock) + sizeof(m_lock) - 1), CacheLine(&m_initialized),
+			CacheLine(&m_running), CacheLine(&m_stopRequested), CacheLine(&m_childValue)};
+	}
+
+	bool LockSpansOneLine() const
+	{
+		return CacheLine(&m_lock) == CacheLine(reinterpret_cast<const char*>(&m_lock) + sizeof(m_lock) - 1);
+	}
+
+	int m_childValue = 0;
+};
+
+
+TEST(MsvCacheLayoutTest, LockableChildMemberDoesNotShareLockCacheLine)
+{
+	TestLayoutLockable lockable;
+
+	EXPECT_FALSE(lockable.ChildSharesLockLine());
+}
+
+TEST(MsvCacheLayoutTest, RunnableLockAndLifecycleFieldsHaveOwnCacheLines)
+{
+	TestLayoutRunnable runnable;
+
+	//lock (one line), m_initialized, m_running, m_stopRequested and child member -> five different lines
+	EXPECT_TRUE(runnable.LockSpansOneLine());
+	EXPECT_EQ(runnable.FieldLines().size(), 5u);
+}
+
+TEST(MsvCacheLayoutTest, HotFieldsHaveOwnCacheLines)
+{
+	struct HotFields
+	{
+		MsvHotField<std::atomic<int>> first{0};
+		MsvHotField<std::atomic<int>> second{0};
+		int cold = 0;
+	} fields;
+
+	EXPECT_EQ(alignof(MsvHotField<int>), static_cast<size_t>(MSV_CACHE_LINE_SIZE));
+	EXPECT_EQ(sizeof(MsvHotField<int>), static_cast<size_t>(MSV_CACHE_LINE_SIZE));
+	EXPECT_NE(CacheLine(&fields.first), CacheLine(&fields.second));
+	EXPECT_NE(CacheLine(&fields.second), CacheLine(&fields.cold));
+}
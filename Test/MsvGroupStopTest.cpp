@@ -0,0 +1,187 @@
+#include "MsvGroupStop.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+class TestGroupRunnableInterface
+{
+public:
+	virtual ~TestGroupRunnableInterface() = default;
+
+	virtual void Stop() = 0;
+};
+
+
+//runnable with worker loop which checks cancellation token, Stop joins the worker
+class TestGroupRunnable:
+	public MsvRunnable<TestGroupRunnableInterface>
+{
+public:
+	TestGroupRunnable():
+		m_worker(&TestGroupRunnable::WorkerLoop, this)
+	{
+
+	}
+
+	~TestGroupRunnable()
+	{
+		if (m_worker.joinable())
+		{
+			RequestStop();
+			m_worker.join();
+		}
+	}
+
+	virtual void Stop() override
+	{
+		m_worker.join();
+	}
+
+protected:
+	void WorkerLoop()
+	{
+		while (!StopRequested())
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+
+	std::thread m_worker;
+};
+
+
+//runnable whose Stop blocks until it is released (e.g. blocked on I/O)
+class BlockingGroupRunnable:
+	public MsvRunnable<TestGroupRunnableInterface>
+{
+public:
+	BlockingGroupRunnable():
+		m_released(m_release.get_future().share())
+	{
+
+	}
+
+	virtual void Stop() override
+	{
+		m_released.wait();
+	}
+
+	void Release()
+	{
+		m_release.set_value();
+	}
+
+protected:
+	std::promise<void> m_release;
+	std::shared_future<void> m_released;
+};
+
+
+//runnable whose Stop throws
+class ThrowingGroupRunnable:
+	public MsvRunnable<TestGroupRunnableInterface>
+{
+public:
+	virtual void Stop() override
+	{
+		throw std::runtime_error("Stop failed.");
+	}
+};
+
+
+void StopRunnable(std::shared_ptr<MsvRunnable<TestGroupRunnableInterface>>& spRunnable)
+{
+	spRunnable->Stop();
+}
+
+
+TEST(MsvGroupStopTest, StopsAllRunnables)
+{
+	std::vector<std::shared_ptr<TestGroupRunnable>> runnables;
+	for (int i = 0; i < 50; ++i)
+	{
+		runnables.push_back(std::make_shared<TestGroupRunnable>());
+	}
+	runnables.push_back(nullptr);
+
+	//duplicates -> Stop (join of worker) must be called only once
+	runnables.push_back(runnables[0]);
+	runnables.push_back(runnables[1]);
+	runnables.push_back(runnables[0]);
+
+	std::vector<std::shared_ptr<TestGroupRunnable>> notStopped = MsvGroupStop(runnables.begin(), runnables.end(),
+		[](std::shared_ptr<TestGroupRunnable>& spRunnable) { spRunnable->Stop(); }, std::chrono::seconds(30));
+
+	EXPECT_TRUE(notStopped.empty());
+
+	for (std::shared_ptr<TestGroupRunnable>& spRunnable : runnables)
+	{
+		EXPECT_TRUE(!spRunnable || spRunnable->StopRequested());
+	}
+}
+
+TEST(MsvGroupStopTest, StopsEmptyRange)
+{
+	std::vector<std::shared_ptr<TestGroupRunnable>> runnables;
+
+	EXPECT_TRUE(MsvGroupStop(runnables.begin(), runnables.end(), [](std::shared_ptr<TestGroupRunnable>&) {}, std::chrono::seconds(1)).empty());
+}
+
+TEST(MsvGroupStopTest, ReportsRunnablesWhichMissedDeadline)
+{
+	std::shared_ptr<BlockingGroupRunnable> spBlocking = std::make_shared<BlockingGroupRunnable>();
+	std::vector<std::shared_ptr<MsvRunnable<TestGroupRunnableInterface>>> runnables = {std::make_shared<TestGroupRunnable>(), spBlocking,
+		std::make_shared<TestGroupRunnable>()};
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::vector<std::shared_ptr<MsvRunnable<TestGroupRunnableInterface>>> notStopped = MsvGroupStop(runnables.begin(), runnables.end(), StopRunnable,
+		std::chrono::milliseconds(200));
+	std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+
+	ASSERT_EQ(notStopped.size(), 1u);
+	EXPECT_EQ(notStopped[0], runnables[1]);
+	EXPECT_GE(elapsed, std::chrono::milliseconds(200));
+	EXPECT_LT(elapsed, std::chrono::seconds(5));
+
+	spBlocking->Release();
+}
+
+TEST(MsvGroupStopTest, ReportsRunnablesWhoseStopThrows)
+{
+	std::vector<std::shared_ptr<MsvRunnable<TestGroupRunnableInterface>>> runnables = {std::make_shared<TestGroupRunnable>(),
+		std::make_shared<ThrowingGroupRunnable>()};
+
+	std::vector<std::shared_ptr<MsvRunnable<TestGroupRunnableInterface>>> notStopped = MsvGroupStop(runnables.begin(), runnables.end(), StopRunnable,
+		std::chrono::seconds(30));
+
+	ASSERT_EQ(notStopped.size(), 1u);
+	EXPECT_EQ(notStopped[0], runnables[1]);
+}
+
+TEST(MsvGroupStopTest, MaximalTimeoutWaitsForAllRunnables)
+{
+	std::vector<std::shared_ptr<TestGroupRunnable>> runnables = {std::make_shared<TestGroupRunnable>(), std::make_shared<TestGroupRunnable>(),
+		std::make_shared<TestGroupRunnable>()};
+
+	std::vector<std::shared_ptr<TestGroupRunnable>> notStopped = MsvGroupStop(runnables.begin(), runnables.end(),
+		[](std::shared_ptr<TestGroupRunnable>& spRunnable)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			spRunnable->Stop();
+		},
+		std::chrono::steady_clock::duration::max());
+
+	EXPECT_TRUE(notStopped.empty());
+
+	notStopped = MsvGroupStop(runnables.begin(), runnables.end(), [](std::shared_ptr<TestGroupRunnable>&) {}, std::chrono::hours::max());
+
+	EXPECT_TRUE(notStopped.empty());
+}
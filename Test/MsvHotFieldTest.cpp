@@ -0,0 +1,47 @@
+#include "MsvHotField.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+
+
+TEST(MsvHotFieldTest, ConstructsValueFromArguments)
+{
+	MsvHotField<std::string> text(3, 'x');
+	MsvHotField<std::atomic<int>> counter(5);
+	MsvHotField<int> zero;
+
+	EXPECT_EQ(text.Get(), "xxx");
+	EXPECT_EQ(text->size(), 3u);
+	EXPECT_EQ(counter->load(), 5);
+	EXPECT_EQ(zero.Get(), 0);
+}
+
+TEST(MsvHotFieldTest, CopiesAndMovesValue)
+{
+	MsvHotField<int> origin(7);
+	const MsvHotField<int> constOrigin(8);
+
+	MsvHotField<int> copy(origin);
+	MsvHotField<int> constCopy(constOrigin);
+	EXPECT_EQ(copy.Get(), 7);
+	EXPECT_EQ(constCopy.Get(), 8);
+
+	copy = constOrigin;
+	EXPECT_EQ(copy.Get(), 8);
+
+	MsvHotField<std::unique_ptr<int>> pointer(new int(9));
+	MsvHotField<std::unique_ptr<int>> moved(std::move(pointer));
+	EXPECT_EQ(*moved.Get(), 9);
+	EXPECT_FALSE(pointer.Get());
+}
+
+TEST(MsvHotFieldTest, IsAlignedAndPaddedToCacheLine)
+{
+	EXPECT_EQ(alignof(MsvHotField<char>), static_cast<size_t>(MSV_CACHE_LINE_SIZE));
+	EXPECT_EQ(sizeof(MsvHotField<char>), static_cast<size_t>(MSV_CACHE_LINE_SIZE));
+	EXPECT_EQ(sizeof(MsvHotField<char[MSV_CACHE_LINE_SIZE + 1]>), static_cast<size_t>(2 * MSV_CACHE_LINE_SIZE));
+}
@@ -0,0 +1,204 @@
+#include "MsvMultiLock.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+
+class TestLockable:
+	public MsvLockable
+{
+public:
+	bool LockedByOtherThread() const
+	{
+		//try_lock from this thread would succeed (recursive mutex) -> try it from another thread
+		return std::async(std::launch::async, [this]()
+		{
+			if (m_lock.try_lock())
+			{
+				m_lock.unlock();
+				return false;
+			}
+
+			return true;
+		}).get();
+	}
+
+	int64_t m_value = 0;
+	std::atomic<int> m_holders{0};
+};
+
+
+TEST(MsvMultiLockTest, LocksAndUnlocksAllObjects)
+{
+	TestLockable a, b, c;
+
+	{
+		MsvMultiLock lock({&a, &b, &c});
+
+		EXPECT_TRUE(a.LockedByOtherThread());
+		EXPECT_TRUE(b.LockedByOtherThread());
+		EXPECT_TRUE(c.LockedByOtherThread());
+	}
+
+	EXPECT_FALSE(a.LockedByOtherThread());
+	EXPECT_FALSE(b.LockedByOtherThread());
+	EXPECT_FALSE(c.LockedByOtherThread());
+}
+
+TEST(MsvMultiLockTest, IgnoresNullsAndDuplicates)
+{
+	TestLockable a, b;
+
+	{
+		MsvMultiLock lock({&a, nullptr, &b, &a, &a, nullptr});
+
+		EXPECT_TRUE(a.LockedByOtherThread());
+		EXPECT_TRUE(b.LockedByOtherThread());
+	}
+
+	EXPECT_FALSE(a.LockedByOtherThread());
+	EXPECT_FALSE(b.LockedByOtherThread());
+}
+
+TEST(MsvMultiLockTest, LocksRangeOfSharedPointers)
+{
+	std::vector<std::shared_ptr<TestLockable>> objects = {std::make_shared<TestLockable>(), nullptr, std::make_shared<TestLockable>()};
+
+	{
+		MsvMultiLock lock(objects.begin(), objects.end());
+
+		EXPECT_TRUE(objects[0]->LockedByOtherThread());
+		EXPECT_TRUE(objects[2]->LockedByOtherThread());
+	}
+
+	EXPECT_FALSE(objects[0]->LockedByOtherThread());
+	EXPECT_FALSE(objects[2]->LockedByOtherThread());
+}
+
+TEST(MsvMultiLockTest, LocksMoreObjectsThanInlineCapacity)
+{
+	std::vector<std::shared_ptr<TestLockable>> objects;
+	for (int i = 0; i < 20; ++i)
+	{
+		objects.push_back(std::make_shared<TestLockable>());
+	}
+
+	//duplicates of all objects -> 40 pointers, 20 objects
+	std::vector<TestLockable*> lockSet;
+	for (int i = 0; i < 2; ++i)
+	{
+		for (std::shared_ptr<TestLockable>& spObject : objects)
+		{
+			lockSet.push_back(spObject.get());
+		}
+	}
+
+	{
+		MsvMultiLock lock(lockSet.begin(), lockSet.end());
+
+		for (std::shared_ptr<TestLockable>& spObject : objects)
+		{
+			EXPECT_TRUE(spObject->LockedByOtherThread());
+		}
+	}
+
+	for (std::shared_ptr<TestLockable>& spObject : objects)
+	{
+		EXPECT_FALSE(spObject->LockedByOtherThread());
+	}
+}
+
+TEST(MsvMultiLockTest, LocksEmptyRange)
+{
+	std::vector<TestLockable*> objects;
+
+	MsvMultiLock lock(objects.begin(), objects.end());
+}
+
+TEST(MsvMultiLockTest, RandomizedLockSetsDoNotDeadlock)
+{
+	const size_t objectCount = 32;
+	const size_t threadCount = 8;
+	const int iterations = 20000;
+	const int64_t initialValue = 1000;
+
+	std::vector<std::shared_ptr<TestLockable>> objects;
+	for (size_t i = 0; i < objectCount; ++i)
+	{
+		objects.push_back(std::make_shared<TestLockable>());
+		objects.back()->m_value = initialValue;
+	}
+
+	std::atomic<int> exclusionViolations(0);
+	std::vector<std::thread> threads;
+
+	for (size_t t = 0; t < threadCount; ++t)
+	{
+		threads.emplace_back([&objects, &exclusionViolations, t]()
+		{
+			std::mt19937 random(static_cast<unsigned>(t));
+
+			for (int i = 0; i < iterations; ++i)
+			{
+				//random lock set (with possible duplicates) in random order
+				std::vector<std::shared_ptr<TestLockable>> lockSet;
+				size_t lockSetSize = 2 + random() % 5;
+				for (size_t j = 0; j < lockSetSize; ++j)
+				{
+					lockSet.push_back(objects[random() % objects.size()]);
+				}
+
+				MsvMultiLock lock(lockSet.begin(), lockSet.end());
+
+				std::vector<TestLockable*> uniqueObjects;
+				for (std::shared_ptr<TestLockable>& spObject : lockSet)
+				{
+					uniqueObjects.push_back(spObject.get());
+				}
+				std::sort(uniqueObjects.begin(), uniqueObjects.end());
+				uniqueObjects.erase(std::unique(uniqueObjects.begin(), uniqueObjects.end()), uniqueObjects.end());
+
+				//no other thread may hold any object of the lock set now
+				for (TestLockable* pObject : uniqueObjects)
+				{
+					if (pObject->m_holders.exchange(1) != 0)
+					{
+						++exclusionViolations;
+					}
+				}
+
+				//transfer from first to last object
+				lockSet.front()->m_value -= 1;
+				lockSet.back()->m_value += 1;
+
+				for (TestLockable* pObject : uniqueObjects)
+				{
+					pObject->m_holders.store(0);
+				}
+			}
+		});
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	int64_t sum = 0;
+	for (std::shared_ptr<TestLockable>& spObject : objects)
+	{
+		sum += spObject->m_value;
+		EXPECT_FALSE(spObject->LockedByOtherThread());
+	}
+
+	EXPECT_EQ(sum, initialValue * static_cast<int64_t>(objectCount));
+	EXPECT_EQ(exclusionViolations.load(), 0);
+}
+
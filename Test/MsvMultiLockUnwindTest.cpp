@@ -0,0 +1,86 @@
+//pthread_mutex_lock is interposed for whole executable -> this test has own executable (see CMakeLists.txt).
+
+#include "MsvMultiLock.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cerrno>
+#include <future>
+#include <system_error>
+
+#include <dlfcn.h>
+#include <pthread.h>
+
+
+namespace
+{
+	std::atomic<pthread_mutex_t*> g_failingMutex(nullptr);
+	std::atomic<int> g_failedLocks(0);
+}
+
+//interposes pthread_mutex_lock -> locking of g_failingMutex fails (std::recursive_mutex::lock throws)
+extern "C" int pthread_mutex_lock(pthread_mutex_t* mutex)
+{
+	using PthreadMutexLock = int (*)(pthread_mutex_t*);
+	static std::atomic<PthreadMutexLock> s_pthreadMutexLock(nullptr);
+
+	if (mutex == g_failingMutex.load())
+	{
+		++g_failedLocks;
+		return EAGAIN;
+	}
+
+	PthreadMutexLock pthreadMutexLock = s_pthreadMutexLock.load();
+	if (!pthreadMutexLock)
+	{
+		pthreadMutexLock = reinterpret_cast<PthreadMutexLock>(dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+		s_pthreadMutexLock.store(pthreadMutexLock);
+	}
+
+	return pthreadMutexLock(mutex);
+}
+
+
+class TestUnwindLockable:
+	public MsvLockable
+{
+public:
+	bool LockedByOtherThread() const
+	{
+		//try_lock from this thread would succeed (recursive mutex) -> try it from another thread
+		return std::async(std::launch::async, [this]()
+		{
+			if (m_lock.try_lock())
+			{
+				m_lock.unlock();
+				return false;
+			}
+
+			return true;
+		}).get();
+	}
+
+	std::recursive_mutex& Lock()
+	{
+		return m_lock;
+	}
+};
+
+
+TEST(MsvMultiLockUnwindTest, UnlocksLockedObjectsWhenLockThrows)
+{
+	TestUnwindLockable objects[3];
+
+	//objects are locked in address order -> the last one fails after the first two have been locked
+	g_failingMutex = objects[2].Lock().native_handle();
+
+	EXPECT_THROW(MsvMultiLock({&objects[2], &objects[0], &objects[1]}), std::system_error);
+
+	g_failingMutex = nullptr;
+
+	EXPECT_EQ(g_failedLocks.load(), 1);
+	EXPECT_FALSE(objects[0].LockedByOtherThread());
+	EXPECT_FALSE(objects[1].LockedByOtherThread());
+	EXPECT_FALSE(objects[2].LockedByOtherThread());
+}
@@ -0,0 +1,86 @@
+#include "MsvRunnable.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+
+class TestRunnableInterface
+{
+public:
+	virtual ~TestRunnableInterface() = default;
+};
+
+
+class TestRunnable:
+	public MsvRunnable<TestRunnableInterface>
+{
+public:
+	void Start()
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+		ClearStopRequest();
+		m_running = true;
+	}
+
+	std::recursive_mutex& Lock()
+	{
+		return m_lock;
+	}
+};
+
+
+TEST(MsvRunnableTest, IsConstructedNotRunningAndNotStopRequested)
+{
+	TestRunnable runnable;
+
+	EXPECT_FALSE(runnable.Initialized());
+	EXPECT_FALSE(runnable.Running());
+	EXPECT_FALSE(runnable.StopRequested());
+}
+
+TEST(MsvRunnableTest, RequestStopSetsAndClearStopRequestResetsToken)
+{
+	TestRunnable runnable;
+
+	runnable.RequestStop();
+	EXPECT_TRUE(runnable.StopRequested());
+
+	runnable.RequestStop();
+	EXPECT_TRUE(runnable.StopRequested());
+
+	runnable.Start();
+	EXPECT_FALSE(runnable.StopRequested());
+	EXPECT_TRUE(runnable.Running());
+}
+
+TEST(MsvRunnableTest, StopRequestedIsVisibleToWorkerLoopWithoutLocking)
+{
+	TestRunnable runnable;
+	std::atomic<bool> workerStarted(false);
+
+	//lock is held by this thread for whole test -> worker would block if StopRequested locked
+	std::lock_guard<std::recursive_mutex> lock(runnable.Lock());
+
+	std::thread worker([&runnable, &workerStarted]()
+	{
+		workerStarted = true;
+
+		while (!runnable.StopRequested())
+		{
+			std::this_thread::yield();
+		}
+	});
+
+	while (!workerStarted)
+	{
+		std::this_thread::yield();
+	}
+
+	runnable.RequestStop();
+	worker.join();
+
+	EXPECT_TRUE(runnable.StopRequested());
+}